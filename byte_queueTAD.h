@@ -0,0 +1,168 @@
+/**
+ * Arquivo: byte_queueTAD.h
+ * Versão : 1.0
+ * Data   : 2026-10-18 18:40
+ * -------------------------
+ * Este arquivo define a interface byte_queueTAD.h, uma FILA DE BYTES cujos
+ * elementos são registros de tamanho variável armazenados diretamente (sem
+ * ponteiros para buffers externos) num único buffer contíguo.
+ *
+ * A interface é de CÓPIA ZERO: o produtor reserva espaço na fila e escreve o
+ * registro no próprio buffer da fila ("reservar" -> escrita -> "confirmar"), e
+ * o consumidor lê o registro diretamente no buffer ("espiar" -> leitura ->
+ * "liberar"). Os dados nunca são copiados entre produtor e consumidor.
+ *
+ * A fila NÃO é segura para uso concorrente: produtor e consumidor podem
+ * intercalar as suas chamadas (inclusive entre "reservar" e "confirmar"), mas
+ * todas as chamadas devem partir da mesma thread ou ser serializadas pelo
+ * cliente.
+ *
+ * Os status de retorno são os mesmos da interface queueTAD.h.
+ */
+
+/*** Inicia Boilerplate da Interface ***/
+
+#ifndef _BYTE_QUEUETAD_H
+#define _BYTE_QUEUETAD_H
+
+/*** Includes ***/
+
+#include "queueTAD.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*** Tipos de Dados ***/
+
+/**
+ * Tipo abstrato: byte_queueTAD
+ * ----------------------------
+ * O tipo "byte_queueTAD" é um tipo abstrato de dado para representar uma fila
+ * de registros de bytes. É definido como um ponteiro para byte_queueTCD (o tipo
+ * concreto que implementa a fila), que está disponível apenas para a
+ * implementação, não para os clientes.
+ */
+
+typedef struct byte_queueTCD *byte_queueTAD;
+
+/*** Declarações de Subprogramas ***/
+
+/**
+ * Função: CRIAR_BYTE_QUEUE
+ * Uso: queue = criar_byte_queue(capacidade);
+ * ------------------------------------------
+ * Aloca e retorna uma fila de bytes vazia com "capacidade" bytes de buffer
+ * (cada registro ocupa, além dos seus dados, um pequeno cabeçalho e um
+ * preenchimento de alinhamento). Se não for possível criar a fila, ou se a
+ * capacidade for zero, retorna o valor NULL.
+ */
+
+byte_queueTAD
+criar_byte_queue (size_t capacidade);
+
+/**
+ * Função: REMOVER_BYTE_QUEUE
+ * Uso: status = remover_byte_queue(&queue);
+ * -----------------------------------------
+ * Recebe um PONTEIRO para um byte_queueTAD e libera toda a memória da fila. Os
+ * possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso (o ponteiro "queue" informado
+ *        será direcionado para NULL);
+ *     b) QUEUE_ERRO_ARGUMENTO: ponteiro passado como argumento não é válido; e
+ *     c) QUEUE_ERRO_QUEUE: queue inválida.
+ */
+
+queue_status
+remover_byte_queue (byte_queueTAD *queue);
+
+/**
+ * Função: RESERVAR
+ * Uso: status = reservar(queue, tamanho, &destino);
+ * -------------------------------------------------
+ * Reserva, no final da fila, espaço contíguo para um registro de "tamanho"
+ * bytes e coloca em "destino" o endereço onde o produtor deve escrever o
+ * registro. O registro só se torna visível para o consumidor após "confirmar".
+ * Só pode haver uma reserva pendente por vez. Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso; "destino" aponta para
+ *        "tamanho" bytes alinhados e graváveis;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida;
+ *     c) QUEUE_ERRO_ARGUMENTO: "destino" inválido, "tamanho" igual a zero ou
+ *        maior do que a capacidade da fila, ou já há uma reserva pendente; e
+ *     d) QUEUE_ERRO_CHEIA: não há espaço contíguo livre suficiente no momento.
+ *
+ * O valor armazenado em "destino" só é válido se a função retornar QUEUE_OK, e
+ * apenas até a chamada de "confirmar".
+ */
+
+queue_status
+reservar (byte_queueTAD queue, size_t tamanho, void **destino);
+
+/**
+ * Função: CONFIRMAR
+ * Uso: status = confirmar(queue);
+ * -------------------------------
+ * Publica o registro reservado por "reservar", enfileirando-o no final da fila.
+ * Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida; e
+ *     c) QUEUE_ERRO_ARGUMENTO: não há reserva pendente.
+ */
+
+queue_status
+confirmar (byte_queueTAD queue);
+
+/**
+ * Função: ESPIAR
+ * Uso: status = espiar(queue, &dados, &tamanho);
+ * ----------------------------------------------
+ * Coloca em "dados" o endereço do registro no início da fila e em "tamanho" o
+ * seu tamanho em bytes, SEM desenfileirar o registro. Os possíveis retornos
+ * são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida;
+ *     c) QUEUE_ERRO_ARGUMENTO: ponteiro "dados" ou "tamanho" inválido; e
+ *     d) QUEUE_ERRO_VAZIA: queue vazia.
+ *
+ * Os valores armazenados em "dados" e "tamanho" só são válidos se a função
+ * retornar QUEUE_OK, e apenas até a chamada de "liberar".
+ */
+
+queue_status
+espiar (const byte_queueTAD queue, const void **dados, size_t *tamanho);
+
+/**
+ * Função: LIBERAR
+ * Uso: status = liberar(queue);
+ * -----------------------------
+ * Desenfileira o registro no início da fila (o mesmo retornado por "espiar"),
+ * devolvendo o seu espaço para o produtor. Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida; e
+ *     c) QUEUE_ERRO_VAZIA: queue vazia.
+ */
+
+queue_status
+liberar (byte_queueTAD queue);
+
+/**
+ * Função: NUM_REGISTROS
+ * Uso: status = num_registros(queue, &nreg);
+ * ------------------------------------------
+ * Armazena no local apontado por "nreg" a quantidade atual de registros
+ * confirmados na fila. Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_ARGUMENTO: ponteiro "nreg" inválido; e
+ *     c) QUEUE_ERRO_QUEUE: queue inválida.
+ */
+
+queue_status
+num_registros (const byte_queueTAD queue, size_t *nreg);
+
+/*** Finaliza Boilerplate da Interface ***/
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * Arquivo: byte_queueTAD_anel.c
+ * Versão : 1.0
+ * Data   : 2026-10-18 18:40
+ * -------------------------
+ * Este arquivo implementa a interface byte_queueTAD.h através de um buffer
+ * circular (anel) de tamanho fixo, no qual cada registro é armazenado de forma
+ * contígua: um cabeçalho com o tamanho do registro seguido dos seus dados. Um
+ * registro nunca é dividido entre o final e o início do buffer; se não couber
+ * no final, é colocado no início e a parte final não utilizada é ignorada até
+ * que o consumidor chegue a ela.
+ */
+
+/*** Includes ***/
+
+#include "byte_queueTAD.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/*** Constantes Simbólicas ***/
+
+/**
+ * Constantes: ALINHAMENTO, TAM_CABECALHO
+ * --------------------------------------
+ * Todos os registros começam em endereços múltiplos de ALINHAMENTO bytes, e o
+ * cabeçalho de cada registro (que guarda o seu tamanho) ocupa TAM_CABECALHO
+ * bytes, de modo que os dados do registro também ficam alinhados.
+ */
+
+#define ALINHAMENTO   ((size_t) 8)
+#define ALINHAR(n)    (((n) + ALINHAMENTO - 1) & ~(ALINHAMENTO - 1))
+#define TAM_CABECALHO ALINHAR(sizeof(size_t))
+
+/*** Tipos de Dados ***/
+
+/**
+ * Tipo: struct byte_queueTCD
+ * --------------------------
+ * Representação concreta da fila de bytes. O buffer "dados" tem "capacidade"
+ * bytes; os registros confirmados ocupam:
+ *
+ *     a) se "envolto" for false: o intervalo [inicio, fim); e
+ *     b) se "envolto" for true: os intervalos [inicio, limite) e [0, fim).
+ *
+ * Uma reserva pendente ocupa "reserva" bytes a partir de "posicao_reserva", e
+ * só é incorporada ao intervalo de registros em "confirmar".
+ */
+
+struct byte_queueTCD
+{
+    unsigned char *dados;
+    size_t capacidade;
+    size_t inicio;
+    size_t fim;
+    size_t limite;
+    bool envolto;
+    size_t posicao_reserva;
+    size_t reserva;
+    size_t nregistros;
+};
+
+/*** Definições de Subprogramas Exportados ***/
+
+/**
+ * Função: CRIAR_BYTE_QUEUE
+ * Uso: queue = criar_byte_queue(capacidade);
+ * ------------------------------------------
+ * Aloca a fila e o buffer (com a capacidade arredondada para um múltiplo de
+ * ALINHAMENTO). Retorna NULL em caso de erro.
+ */
+
+byte_queueTAD
+criar_byte_queue (size_t capacidade)
+{
+    if (capacidade == 0)
+        return NULL;
+
+    byte_queueTAD Q = calloc(1, sizeof(struct byte_queueTCD));
+    if (Q == NULL)
+        return NULL;
+
+    Q->capacidade = ALINHAR(capacidade);
+    Q->dados = malloc(Q->capacidade);
+    if (Q->dados == NULL)
+    {
+        free(Q);
+        return NULL;
+    }
+
+    Q->inicio = Q->fim = Q->limite = 0;
+    Q->envolto = false;
+    Q->posicao_reserva = Q->reserva = 0;
+    Q->nregistros = 0;
+    return Q;
+}
+
+/**
+ * Função: REMOVER_BYTE_QUEUE
+ * Uso: status = remover_byte_queue(&queue);
+ * -----------------------------------------
+ * Verifica se o ponteiro e a queue apontada são válidos e libera o buffer e a
+ * fila. Retorna queue_status apropriado.
+ */
+
+queue_status
+remover_byte_queue (byte_queueTAD *queue)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+    else if (*queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+
+    free((*queue)->dados);
+    free(*queue);
+    *queue = NULL;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: RESERVAR
+ * Uso: status = reservar(queue, tamanho, &destino);
+ * -------------------------------------------------
+ * Procura espaço contíguo para o cabeçalho e os dados do registro: primeiro
+ * após o último registro e, se não houver, no início do buffer (apenas se a
+ * fila ainda não estiver "envolta"). Escreve o cabeçalho e retorna em "destino"
+ * o endereço dos dados. Retorna o queue_status apropriado.
+ */
+
+queue_status
+reservar (byte_queueTAD queue, size_t tamanho, void **destino)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (destino == NULL || tamanho == 0 || queue->reserva != 0)
+        return QUEUE_ERRO_ARGUMENTO;
+    else if (tamanho > queue->capacidade - TAM_CABECALHO)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    size_t necessario = TAM_CABECALHO + ALINHAR(tamanho);
+
+    if (queue->nregistros == 0)
+    {
+        queue->inicio = queue->fim = queue->limite = 0;
+        queue->envolto = false;
+    }
+
+    size_t posicao;
+    if (!queue->envolto && queue->capacidade - queue->fim >= necessario)
+        posicao = queue->fim;
+    else if (!queue->envolto && queue->inicio >= necessario)
+        posicao = 0;
+    else if (queue->envolto && queue->inicio - queue->fim >= necessario)
+        posicao = queue->fim;
+    else
+        return QUEUE_ERRO_CHEIA;
+
+    *(size_t *) (queue->dados + posicao) = tamanho;
+    queue->posicao_reserva = posicao;
+    queue->reserva = necessario;
+    *destino = queue->dados + posicao + TAM_CABECALHO;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: CONFIRMAR
+ * Uso: status = confirmar(queue);
+ * -------------------------------
+ * Incorpora a reserva pendente aos registros da fila. Se a reserva foi feita
+ * no início do buffer, a fila passa a estar "envolta" e o final dos registros
+ * antigos é guardado em "limite". Retorna o queue_status apropriado.
+ */
+
+queue_status
+confirmar (byte_queueTAD queue)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (queue->reserva == 0)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    if (!queue->envolto && queue->posicao_reserva != queue->fim)
+    {
+        queue->limite = queue->fim;
+        queue->envolto = true;
+    }
+    queue->fim = queue->posicao_reserva + queue->reserva;
+    queue->reserva = 0;
+    queue->nregistros += 1;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: ESPIAR
+ * Uso: status = espiar(queue, &dados, &tamanho);
+ * ----------------------------------------------
+ * Lê o cabeçalho do registro em "inicio" e retorna o endereço e o tamanho dos
+ * seus dados, sem desenfileirar. Retorna o queue_status apropriado.
+ */
+
+queue_status
+espiar (const byte_queueTAD queue, const void **dados, size_t *tamanho)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (dados == NULL || tamanho == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+    else if (queue->nregistros == 0)
+        return QUEUE_ERRO_VAZIA;
+
+    *tamanho = *(const size_t *) (queue->dados + queue->inicio);
+    *dados = queue->dados + queue->inicio + TAM_CABECALHO;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: LIBERAR
+ * Uso: status = liberar(queue);
+ * -----------------------------
+ * Avança "inicio" para depois do registro atual; ao chegar em "limite", volta
+ * para o início do buffer e a fila deixa de estar "envolta". Se a fila ficar
+ * vazia, "inicio" e "fim" passam para a posição da reserva pendente (ou para o
+ * início do buffer, se não houver), de modo que um "confirmar" posterior não
+ * considere a fila envolta sem registros antigos. Retorna o queue_status
+ * apropriado.
+ */
+
+queue_status
+liberar (byte_queueTAD queue)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (queue->nregistros == 0)
+        return QUEUE_ERRO_VAZIA;
+
+    size_t tamanho = *(const size_t *) (queue->dados + queue->inicio);
+    queue->inicio += TAM_CABECALHO + ALINHAR(tamanho);
+    queue->nregistros -= 1;
+
+    if (queue->nregistros == 0)
+    {
+        queue->inicio = queue->fim = queue->reserva != 0
+                                     ? queue->posicao_reserva : 0;
+        queue->limite = 0;
+        queue->envolto = false;
+    }
+    else if (queue->envolto && queue->inicio == queue->limite)
+    {
+        queue->inicio = 0;
+        queue->envolto = false;
+    }
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: NUM_REGISTROS
+ * Uso: status = num_registros(queue, &nreg);
+ * ------------------------------------------
+ * Armazena em "nreg" a quantidade de registros confirmados na fila.
+ */
+
+queue_status
+num_registros (const byte_queueTAD queue, size_t *nreg)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (nreg == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    *nreg = queue->nregistros;
+    return QUEUE_OK;
+}
@@ -89,6 +89,104 @@ typedef enum
     QUEUE_ERRO_VAZIA
 } queue_status;
 
+/**
+ * Tipo: queue_paginas
+ * -------------------
+ * Define o tipo de página de memória utilizado para os blocos de células da
+ * fila (ver "queue_opcoes"). Os seguintes membros estão definidos:
+ *
+ *     QUEUE_PAGINAS_NORMAIS       : páginas normais (padrão);
+ *     QUEUE_PAGINAS_TRANSPARENTES : páginas normais com pedido de "transparent
+ *                                   huge pages" (THP) ao sistema; e
+ *     QUEUE_PAGINAS_EXPLICITAS    : páginas enormes explícitas (hugetlbfs); se
+ *                                   não houver páginas enormes disponíveis, a
+ *                                   fila usa páginas transparentes.
+ */
+
+typedef enum
+{
+    QUEUE_PAGINAS_NORMAIS,
+    QUEUE_PAGINAS_TRANSPARENTES,
+    QUEUE_PAGINAS_EXPLICITAS
+} queue_paginas;
+
+/**
+ * Tipo: queue_opcoes
+ * ------------------
+ * Opções de criação de uma fila, utilizadas por "criar_queue_opcoes". Uma
+ * estrutura zerada (por exemplo, "queue_opcoes opcoes = {0};") corresponde às
+ * opções padrão de "criar_queue"; basta preencher os campos desejados. Os
+ * campos são:
+ *
+ *     paginas          : tipo de página para os blocos de células;
+ *     vincular_numa    : se true, a memória dos blocos é vinculada ao nó NUMA
+ *                        "no_numa"; se false (padrão), cada página fica no nó
+ *                        da thread que primeiro a tocar ("first touch");
+ *     no_numa          : nó NUMA usado quando "vincular_numa" for true;
+ *     celulas_iniciais : quantidade de células pré-alocadas (e tocadas) pela
+ *                        thread que cria a fila. Sem "vincular_numa", apenas
+ *                        essas células ficam no nó dessa thread (por exemplo,
+ *                        a consumidora): os blocos alocados depois são
+ *                        tocados pela thread que enfileira;
+ *     chaveada         : se true, a fila mantém um índice (tabela de hash) por
+ *                        "elemento.valor" e é uma fila FIFO que só aceita
+ *                        "enqueue_chave" ("enqueue" e "priority_enqueue"
+ *                        retornam QUEUE_ERRO_QUEUE), de modo que cada chave
+ *                        aparece no máximo uma vez na fila;
+ *     num_classes      : se maior do que zero, a fila é dividida em
+ *                        "num_classes" classes de prioridade (a prioridade p
+ *                        vai para a classe p, limitada a 0 .. num_classes - 1)
+ *                        e "dequeue" alterna entre as classes por "deficit
+ *                        round robin" (ver "contadores_classe"); e
+ *     pesos            : vetor com "num_classes" pesos positivos: a cada
+ *                        rodada, a classe i pode entregar até pesos[i]
+ *                        elementos. Se for NULL, todas as classes têm peso 1.
+ *
+ * As opções "paginas" e "no_numa" são "melhor esforço": se o sistema não
+ * oferecer páginas enormes ou NUMA, a fila é criada normalmente com páginas
+ * normais. Já "chaveada" e "num_classes" não podem ser usadas em conjunto, e
+ * "pesos" não pode conter valores menores ou iguais a zero: nesses casos,
+ * "criar_queue_opcoes" retorna NULL.
+ *
+ * Se "paginas", "vincular_numa" ou "celulas_iniciais" forem diferentes do
+ * padrão (QUEUE_PAGINAS_NORMAIS, false e 0), as células são alocadas em
+ * blocos grandes e reaproveitadas: a memória dos blocos só é devolvida ao
+ * sistema em "remover_queue", ou seja, a fila mantém a memória do seu maior
+ * tamanho até ser removida. Com as opções padrão, cada célula é alocada e
+ * liberada individualmente, como em "criar_queue".
+ */
+
+typedef struct
+{
+    queue_paginas paginas;
+    bool vincular_numa;
+    int no_numa;
+    size_t celulas_iniciais;
+    bool chaveada;
+    size_t num_classes;
+    const int *pesos;
+} queue_opcoes;
+
+/**
+ * Tipo: queue_contadores
+ * ----------------------
+ * Contadores de uma classe de prioridade de uma fila criada com "num_classes"
+ * (ver "contadores_classe"):
+ *
+ *     peso            : peso da classe;
+ *     enfileirados    : total de elementos já enfileirados na classe;
+ *     desenfileirados : total de elementos já desenfileirados da classe; e
+ *     pendentes       : elementos da classe atualmente na fila.
+ */
+
+typedef struct
+{
+    int peso;
+    size_t enfileirados;
+    size_t desenfileirados;
+    size_t pendentes;
+} queue_contadores;
+
 /*** Declarações de Subprogramas ***/
 
 /**
@@ -102,6 +200,19 @@ typedef enum
 queueTAD
 criar_queue (void);
 
+/**
+ * Função: CRIAR_QUEUE_OPCOES
+ * Uso: queue = criar_queue_opcoes(&opcoes);
+ * -----------------------------------------
+ * Aloca e retorna uma fila vazia cujas células são alocadas de acordo com as
+ * "opcoes" informadas (ver "queue_opcoes"). Se "opcoes" for NULL, equivale a
+ * "criar_queue". Se não for possível criar a fila, ou se as opções forem
+ * inválidas, retorna o valor NULL.
+ */
+
+queueTAD
+criar_queue_opcoes (const queue_opcoes *opcoes);
+
 /**
  * Função: REMOVER_QUEUE
  * Uso: status = remover_queue(&queue);
@@ -131,13 +242,35 @@ remover_queue (queueTAD *queue);
  * Os possíveis retornos são:
  *
  *     a) QUEUE_OK: operação realizada com sucesso;
- *     b) QUEUE_ERRO_QUEUE: queue inválida; e
+ *     b) QUEUE_ERRO_QUEUE: queue inválida ou criada no modo chaveado (use
+ *        "enqueue_chave"); e
  *     c) QUEUE_ERRO_ARGUMENTO: elemento inválido.
  */
 
 queue_status
 enqueue (queueTAD queue, const elementoT elemento);
 
+/**
+ * Função: ENQUEUE_CHAVE
+ * Uso: status = enqueue_chave(queue, elemento);
+ * ---------------------------------------------
+ * Disponível apenas para filas criadas com a opção "chaveada", que são filas
+ * FIFO: a prioridade é apenas um dado do elemento e não altera a ordem de
+ * saída. Usa o campo "elemento.valor" como chave: se já houver na fila um
+ * elemento pendente com a mesma chave, NÃO enfileira uma cópia; o elemento
+ * existente permanece na mesma posição e fica com a MELHOR (menor) das duas
+ * prioridades. Caso contrário, enfileira o elemento no final da fila. A busca
+ * tem custo O(1) esperado, e o tamanho da fila fica limitado ao número de
+ * chaves distintas. Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso (enfileirado ou agrupado);
+ *     b) QUEUE_ERRO_QUEUE: queue inválida ou não criada no modo chaveado; e
+ *     c) QUEUE_ERRO_ALOCACAO: erro na alocação de memória.
+ */
+
+queue_status
+enqueue_chave (queueTAD queue, const elementoT elemento);
+
 /**
  * Função: DEQUEUE
  * Uso: status = dequeue(queue, &elemento);
@@ -284,15 +417,43 @@ ver_elemento (const queueTAD queue, const size_t posicao, elementoT *elemento);
  * ------------------------------------------------------------
  * Recebe uma "queue", um "elemento" e sua "prioridade", e insere o elemento
  * na posição correta da fila, com base na prioridade (menores valores de
- * prioridade são tratados como mais prioritários).
+ * prioridade são tratados como mais prioritários). Em filas criadas com
+ * "num_classes", o elemento é colocado no final da fila da classe
+ * "prioridade", em tempo O(1) (o mesmo ocorre em "enqueue", com a classe
+ * "elemento.prioridade").
  * Os possíveis retornos são:
  *
  *     a) QUEUE_OK: operação realizada com sucesso;
- *     b) QUEUE_ERRO_QUEUE: queue inválida;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida ou criada no modo chaveado;
  *     c) QUEUE_ERRO_ARGUMENTO: elemento ou prioridade inválidos.
  */
 queue_status
 priority_enqueue(queueTAD queue, const elementoT elemento, int prioridade);
+
+/**
+ * Função: CONTADORES_CLASSE
+ * Uso: status = contadores_classe(queue, classe, &contadores);
+ * ------------------------------------------------------------
+ * Disponível apenas para filas criadas com "num_classes". Nessas filas,
+ * "dequeue" serve as classes não vazias em rodadas ("deficit round robin"): em
+ * cada rodada a classe i entrega até pesos[i] elementos, em ordem de chegada,
+ * e então passa a vez para a próxima classe. Assim "dequeue" continua O(1) e
+ * nenhuma classe fica sem atendimento: um elemento que tem k elementos à sua
+ * frente na sua classe i sai em no máximo (k / pesos[i] + 1) rodadas de, no
+ * máximo, a soma dos pesos em "dequeue"s cada.
+ *
+ * Esta função coloca em "contadores" os contadores da "classe" informada. Os
+ * possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida ou criada sem "num_classes";
+ *     c) QUEUE_ERRO_ARGUMENTO: ponteiro "contadores" inválido; e
+ *     d) QUEUE_ERRO_POSICAO: classe inexistente.
+ */
+
+queue_status
+contadores_classe (const queueTAD queue, size_t classe,
+                   queue_contadores *contadores);
  
 /*** Finaliza Boilerplate da Interface ***/
 
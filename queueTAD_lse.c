@@ -6,6 +6,8 @@
  * Este arquivo implementa a interface queueTAD.h através do uso de uma lista
  * simplesmente encadeada (LSE) sem tamanho máximo definido (a fila pode ser
  * aumentada indefinidamente, a depender apenas dos recursos computacionais).
+ * A representação concreta da fila está em queueTAD_lse_rapido.h, que também
+ * oferece as versões "static inline" sem verificação de enqueue e dequeue.
  *
  * Baseado em: Programming Abstractions in C, de Eric S. Roberts.
  *             Capítulo 10: Linear Structures (pg. 433-439).
@@ -22,55 +24,63 @@
 
 /*** Includes ***/
 
+#define _GNU_SOURCE
+
 #include "queueTAD.h"
+#include "queueTAD_lse_rapido.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 /*** Constantes Simbólicas ***/
 
-/*** Variáveis e Constantes Globais ***/
+/**
+ * Constantes: TAM_BLOCO, TAM_PAGINA_ENORME, MPOL_BIND_LSE
+ * -------------------------------------------------------
+ * TAM_BLOCO é o tamanho, em bytes, de cada bloco de células alocado com páginas
+ * normais; TAM_PAGINA_ENORME é o tamanho (e alinhamento) dos blocos alocados
+ * com páginas enormes. MPOL_BIND_LSE é a política "MPOL_BIND" da chamada de
+ * sistema mbind (definida aqui para não depender de libnuma/numaif.h).
+ */
 
-/*** Tipos de Dados ***/
+#define TAM_BLOCO         ((size_t) 64 * 1024)
+#define TAM_PAGINA_ENORME ((size_t) 2 * 1024 * 1024)
+#define MPOL_BIND_LSE     2
 
 /**
- * Tipo: struct celulaTCD
- * ----------------------
- * Define uma célula (nó) da lista encadeada simples (LSE) que implementará a
- * fila. O tipo concreto é o "celulaTCD"; também é criado um tipo "abstrato" com
- * o nome de "celulaTAD" (na verdade não é um tipo abstrato real, pois a
- * implementação concreta está visível, mas isso simplificará a implementação).
+ * Constante: NBALDES_INICIAL
+ * --------------------------
+ * Quantidade inicial de baldes do índice de chaves das filas no modo chaveado
+ * (deve ser uma potência de 2). O índice dobra de tamanho sempre que passaria
+ * a ter mais da metade dos baldes ocupados.
  */
 
-struct celulaTCD
-{
-    elementoT elemento;
-    struct celulaTCD *proximo;
-};
+#define NBALDES_INICIAL 64
+
+/*** Variáveis e Constantes Globais ***/
 
-typedef struct celulaTCD *celulaTAD;
+/*** Tipos de Dados ***/
 
 /**
- * Tipo: struct queueTCD
- * ---------------------
- * Este tipo define a representação concreta da fila. Esta implementação utiliza
- * uma lista simplesmente encadeada (LSE) para armazenar so dados, e contém
- * apenas os ponteiros "início" e "fim" da lista. Como a implementaçao é através
- * de uma LSE, a lista é considerada dinâmica e não tem tamanho máximo definido.
- * O número de elementos atualmente na fila também é armazenado para facilitar
- * a consulta dessa informação. Nesta implementação:
- *
- *     a) O próximo elemento a ser enfileirado será colocado após a última
- *        célula da lista, apontada pelo ponteiro "fim"; e
- *     b) O próximo elemento a ser desenfileirado será a primeira célula da
- *        lista, apontada pelo ponteiro "inicio".
+ * Tipo: struct entradaTCD
+ * -----------------------
+ * Um balde do índice das filas no modo chaveado: a chave ("elemento.valor") e
+ * a célula pendente com essa chave. O índice é uma tabela de hash de
+ * endereçamento aberto com sondagem linear; baldes vazios têm "celula" NULL.
+ * Como o índice pertence à fila, as células não têm nenhum campo extra.
  */
 
-struct queueTCD
+struct entradaTCD
 {
-    celulaTAD inicio;
-    celulaTAD fim;
-    size_t nelem;
+    int chave;
+    celulaTAD celula;
 };
 
 /**
@@ -97,8 +107,20 @@ typedef enum
 
 /*** Declarações de Suprogramas Privados ***/
 
-static celulaTAD criar_celula (void);
-static celula_status remover_celula (celulaTAD *celula);
+static celulaTAD criar_celula (queueTAD queue);
+static celula_status remover_celula (queueTAD queue, celulaTAD *celula);
+static struct blocoTCD *alocar_bloco (const queue_opcoes *opcoes);
+static void liberar_bloco (struct blocoTCD *bloco);
+static void liberar_celulas (celulaTAD celula);
+static celulaTAD enfileirar_celula (queueTAD queue, const elementoT elemento);
+static size_t balde_da_chave (const queueTAD queue, int chave);
+static size_t buscar_chave (const queueTAD queue, int chave);
+static void desindexar_chave (queueTAD queue, int chave);
+static bool redimensionar_indice (queueTAD queue);
+static size_t classe_da_prioridade (const queueTAD queue, int prioridade);
+static queue_status enqueue_classe (queueTAD queue, const elementoT elemento,
+                                    int prioridade);
+static queue_status dequeue_classes (queueTAD queue, elementoT *elemento);
 
 /*** Definições de Subprogramas Exportados ***/
 
@@ -106,12 +128,29 @@ static celula_status remover_celula (celulaTAD *celula);
  * Função: CRIAR_QUEUE
  * Uso: queue = criar_queue( );
  * ----------------------------
- * Usa calloc para criar a fila e ajusta os ponteiros e a contagem de elementos.
- * Retorna NULL em caso de erro, ou o ponteiro para a fila em caso de sucesso.
+ * Cria a fila com as opções padrão (páginas normais, sem vínculo NUMA e sem
+ * pré-alocação). Retorna NULL em caso de erro, ou o ponteiro para a fila em
+ * caso de sucesso.
  */
 
 queueTAD
 criar_queue (void)
+{
+    return criar_queue_opcoes(NULL);
+}
+
+/**
+ * Função: CRIAR_QUEUE_OPCOES
+ * Uso: queue = criar_queue_opcoes(&opcoes);
+ * -----------------------------------------
+ * Usa calloc para criar a fila, guarda as opções e ajusta os ponteiros e a
+ * contagem de elementos. Se "celulas_iniciais" for maior do que zero, aloca
+ * (e toca, pela thread chamadora) os blocos necessários já na criação. Retorna
+ * NULL em caso de erro, ou o ponteiro para a fila em caso de sucesso.
+ */
+
+queueTAD
+criar_queue_opcoes (const queue_opcoes *opcoes)
 {
     queueTAD Q = calloc(1, sizeof(struct queueTCD));
     if (Q == NULL)
@@ -119,6 +158,87 @@ criar_queue (void)
 
     Q->inicio = Q->fim = NULL;
     Q->nelem = 0;
+    Q->livres = NULL;
+    Q->blocos = NULL;
+    Q->opcoes.paginas = QUEUE_PAGINAS_NORMAIS;
+    Q->opcoes.vincular_numa = false;
+    Q->opcoes.no_numa = 0;
+    Q->opcoes.celulas_iniciais = 0;
+    Q->opcoes.chaveada = false;
+    Q->opcoes.num_classes = 0;
+    Q->opcoes.pesos = NULL;
+    if (opcoes != NULL)
+        Q->opcoes = *opcoes;
+
+    Q->em_blocos = Q->opcoes.paginas != QUEUE_PAGINAS_NORMAIS
+                   || Q->opcoes.vincular_numa
+                   || Q->opcoes.celulas_iniciais > 0;
+
+    if (Q->opcoes.chaveada && Q->opcoes.num_classes > 0)
+    {
+        free(Q);
+        return NULL;
+    }
+
+    Q->classes = NULL;
+    Q->nclasses = 0;
+    Q->ativas_inicio = Q->ativas_fim = NULL;
+    if (Q->opcoes.num_classes > 0)
+    {
+        Q->classes = calloc(Q->opcoes.num_classes, sizeof(struct classeTCD));
+        if (Q->classes == NULL)
+        {
+            free(Q);
+            return NULL;
+        }
+        Q->nclasses = Q->opcoes.num_classes;
+        for (size_t i = 0; i < Q->nclasses; i++)
+        {
+            int peso = Q->opcoes.pesos == NULL ? 1 : Q->opcoes.pesos[i];
+            if (peso <= 0)
+            {
+                free(Q->classes);
+                free(Q);
+                return NULL;
+            }
+            Q->classes[i].inicio = Q->classes[i].fim = NULL;
+            Q->classes[i].deficit = 0;
+            Q->classes[i].ativa = false;
+            Q->classes[i].proxima_ativa = NULL;
+            Q->classes[i].contadores.peso = peso;
+        }
+        Q->opcoes.pesos = NULL;
+    }
+
+    Q->indice = NULL;
+    Q->nbaldes = 0;
+    Q->nindexadas = 0;
+    if (Q->opcoes.chaveada)
+    {
+        Q->indice = calloc(NBALDES_INICIAL, sizeof(struct entradaTCD));
+        if (Q->indice == NULL)
+        {
+            free(Q->classes);
+            free(Q);
+            return NULL;
+        }
+        Q->nbaldes = NBALDES_INICIAL;
+    }
+
+    size_t nlivres = 0;
+    while (nlivres < Q->opcoes.celulas_iniciais)
+    {
+        celulaTAD C = queue_lse_novo_bloco(Q);
+        if (C == NULL)
+        {
+            remover_queue(&Q);
+            return NULL;
+        }
+        devolver_celula(Q, C);
+        nlivres += (Q->blocos->tamanho - sizeof(struct blocoTCD))
+                   / sizeof(struct celulaTCD);
+    }
+
     return Q;
 }
 
@@ -127,7 +247,9 @@ criar_queue (void)
  * Uso: status = remover_queue(&queue);
  * ------------------------------------
  * Verifica se o ponteiro e a queue apontada são válidos e libera toda a memória
- * da queue. Retorna queue_status apropriado.
+ * da queue. Nas filas em blocos, todas as células pertencem a algum bloco e
+ * basta liberar os blocos, sem percorrer as células; nas demais, cada célula é
+ * liberada. Retorna queue_status apropriado.
  */
 
 queue_status
@@ -138,19 +260,25 @@ remover_queue (queueTAD *queue)
     else if (*queue == NULL)
         return QUEUE_ERRO_QUEUE;
 
-    celulaTAD atual, proximo;
-    celula_status status;
-    
-    atual = (*queue)->inicio;
+    if (!(*queue)->em_blocos)
+    {
+        liberar_celulas((*queue)->inicio);
+        for (size_t i = 0; i < (*queue)->nclasses; i++)
+            liberar_celulas((*queue)->classes[i].inicio);
+    }
+
+    struct blocoTCD *atual, *proximo;
+
+    atual = (*queue)->blocos;
     while (atual != NULL)
     {
         proximo = atual->proximo;
-        status = remover_celula(&atual);
-        if (status != CELULA_OK)
-            return QUEUE_ERRO_ALOCACAO;
+        liberar_bloco(atual);
         atual = proximo;
     }
     
+    free((*queue)->indice);
+    free((*queue)->classes);
     free(*queue);
     *queue = NULL;
     
@@ -161,34 +289,65 @@ remover_queue (queueTAD *queue)
  * Função: ENQUEUE
  * Uso: status = enqueue(queue, elemento);
  * ---------------------------------------
- * Verifica se a queue é válida e enfileira o elemento informado. Retorna o
- * queue_status apropriado.
+ * Verifica se a queue é válida (e não está no modo chaveado) e enfileira o
+ * elemento informado. Retorna o queue_status apropriado.
  */
 
 queue_status
 enqueue (queueTAD queue, const elementoT elemento)
 {
-    if (queue == NULL)
+    if (queue == NULL || queue->indice != NULL)
         return QUEUE_ERRO_QUEUE;
+    else if (queue->classes != NULL)
+        return enqueue_classe(queue, elemento, elemento.prioridade);
     
-    celulaTAD nova = criar_celula();
-    if (nova == NULL)
+    if (enfileirar_celula(queue, elemento) == NULL)
         return QUEUE_ERRO_ALOCACAO;
+    
+    return QUEUE_OK;
+}
 
-    nova->elemento = elemento;
-    nova->proximo = NULL;
+/**
+ * Função: ENQUEUE_CHAVE
+ * Uso: status = enqueue_chave(queue, elemento);
+ * ---------------------------------------------
+ * Verifica se a queue é válida e está no modo chaveado e procura a chave
+ * "elemento.valor" no índice. Se encontrar, mantém na célula existente a menor
+ * das prioridades; se não, enfileira o elemento no final da fila e o indexa
+ * (aumentando o índice antes, se necessário). Retorna o queue_status
+ * apropriado.
+ */
 
-    if (queue->inicio == NULL)
+queue_status
+enqueue_chave (queueTAD queue, const elementoT elemento)
+{
+    if (queue == NULL || queue->indice == NULL)
+        return QUEUE_ERRO_QUEUE;
+
+    size_t b = buscar_chave(queue, elemento.valor);
+    celulaTAD existente = queue->indice[b].celula;
+    if (existente != NULL)
     {
-        queue->inicio = nova;
+        if (elemento.prioridade < existente->elemento.prioridade)
+            existente->elemento.prioridade = elemento.prioridade;
+        return QUEUE_OK;
     }
-    else
+
+    if ((queue->nindexadas + 1) * 2 > queue->nbaldes)
     {
-        queue->fim->proximo = nova;
+        if (redimensionar_indice(queue))
+            b = buscar_chave(queue, elemento.valor);
+        else if (queue->nindexadas + 1 >= queue->nbaldes)
+            return QUEUE_ERRO_ALOCACAO;
     }
-    queue->fim = nova;
-    queue->nelem += 1;
-    
+
+    celulaTAD nova = enfileirar_celula(queue, elemento);
+    if (nova == NULL)
+        return QUEUE_ERRO_ALOCACAO;
+
+    queue->indice[b].chave = elemento.valor;
+    queue->indice[b].celula = nova;
+    queue->nindexadas += 1;
     return QUEUE_OK;
 }
 
@@ -210,15 +369,20 @@ dequeue (queueTAD queue, elementoT *elemento)
         return QUEUE_ERRO_ARGUMENTO;
     else if (queue->nelem == 0)
         return QUEUE_ERRO_VAZIA;
+    else if (queue->classes != NULL)
+        return dequeue_classes(queue, elemento);
 
     *elemento = queue->inicio->elemento;
 
     celulaTAD temp = queue->inicio;
     celula_status status;
     
+    if (queue->indice != NULL)
+        desindexar_chave(queue, temp->elemento.valor);
+
     queue->inicio = temp->proximo;
     
-    status = remover_celula(&temp);
+    status = remover_celula(queue, &temp);
     if (status != CELULA_OK)
         return QUEUE_ERRO_ALOCACAO;
 
@@ -340,8 +504,23 @@ ver_elemento (const queueTAD queue, const size_t posicao, elementoT *elemento)
         return QUEUE_ERRO_POSICAO;
 
     celulaTAD temp = queue->inicio;
-    for (size_t i = 0; i < posicao; i++)
-        temp = temp->proximo;
+    size_t restantes = posicao;
+    if (queue->classes != NULL)
+    {
+        /* Com classes, as posições seguem a ordem das classes (0, 1, ...),
+           e não a ordem em que "dequeue" entregará os elementos. */
+        size_t c = 0;
+        for (temp = queue->classes[c].inicio;
+             temp == NULL || restantes > 0;
+             temp = temp == NULL ? queue->classes[++c].inicio : temp->proximo)
+            if (temp != NULL)
+                restantes--;
+    }
+    else
+    {
+        for (size_t i = 0; i < posicao; i++)
+            temp = temp->proximo;
+    }
     *elemento = temp->elemento;
     
     return QUEUE_OK;
@@ -352,16 +531,17 @@ ver_elemento (const queueTAD queue, const size_t posicao, elementoT *elemento)
 
 /**
  * Função: CRIAR_CELULA
- * Uso: celula = criar_celula( );
- * ------------------------------
- * Aloca a memória e cria uma nova célula para a LSE. Retorna o ponteiro para a
- * célula alocada, ou NULL em caso de erro.
+ * Uso: celula = criar_celula(queue);
+ * ----------------------------------
+ * Obtém uma nova célula para a LSE a partir da lista de células livres da
+ * "queue" (alocando um novo bloco, se necessário). Retorna o ponteiro para a
+ * célula, ou NULL em caso de erro.
  */
 
 static celulaTAD
-criar_celula (void)
+criar_celula (queueTAD queue)
 {
-    celulaTAD C = calloc(1, sizeof(struct celulaTCD));
+    celulaTAD C = obter_celula(queue);
     if (C == NULL)
         return NULL;
 
@@ -371,19 +551,19 @@ criar_celula (void)
 
 /**
  * Função: REMOVER_CELULA
- * Uso: status = remover_celula(&celula);
- * --------------------------------------
- * Recebe um ponteiro para uma celulaTAD e faz a liberação de memória dessa
- * célula, retornando CELULA_OK. Em caso de erro, retorna o celula_status
- * correspondente.
+ * Uso: status = remover_celula(queue, &celula);
+ * ---------------------------------------------
+ * Recebe um ponteiro para uma celulaTAD e devolve essa célula para a lista de
+ * células livres da "queue", retornando CELULA_OK. Em caso de erro, retorna o
+ * celula_status correspondente.
  */
 
 static celula_status
-remover_celula (celulaTAD *celula)
+remover_celula (queueTAD queue, celulaTAD *celula)
 {
     if (celula && *celula)
     {
-        free(*celula);
+        devolver_celula(queue, *celula);
         *celula = NULL;
         return CELULA_OK;
     }
@@ -391,6 +571,293 @@ remover_celula (celulaTAD *celula)
     return CELULA_ERRO_ALOCACAO;
 }
 
+/**
+ * Função: LIBERAR_CELULAS
+ * Uso: liberar_celulas(celula);
+ * -----------------------------
+ * Libera com free a "celula" e todas as células seguintes da LSE (apenas para
+ * filas que não usam blocos).
+ */
+
+static void
+liberar_celulas (celulaTAD celula)
+{
+    celulaTAD proximo;
+    while (celula != NULL)
+    {
+        proximo = celula->proximo;
+        free(celula);
+        celula = proximo;
+    }
+}
+
+/**
+ * Função: ENFILEIRAR_CELULA
+ * Uso: celula = enfileirar_celula(queue, elemento);
+ * -------------------------------------------------
+ * Cria uma célula com o "elemento" e a coloca no final da LSE da "queue".
+ * Retorna a célula criada, ou NULL em caso de erro de alocação.
+ */
+
+static celulaTAD
+enfileirar_celula (queueTAD queue, const elementoT elemento)
+{
+    celulaTAD nova = criar_celula(queue);
+    if (nova == NULL)
+        return NULL;
+
+    nova->elemento = elemento;
+    nova->proximo = NULL;
+
+    if (queue->inicio == NULL)
+        queue->inicio = nova;
+    else
+        queue->fim->proximo = nova;
+    queue->fim = nova;
+    queue->nelem += 1;
+
+    return nova;
+}
+
+/**
+ * Função: QUEUE_LSE_NOVO_BLOCO
+ * Uso: celula = queue_lse_novo_bloco(queue);
+ * ------------------------------------------
+ * Aloca um novo bloco conforme as opções da "queue", encadeia o bloco na lista
+ * de blocos e coloca todas as suas células, menos a primeira, na lista de
+ * livres. Retorna a primeira célula do bloco, ou NULL em caso de erro.
+ */
+
+celulaTAD
+queue_lse_novo_bloco (queueTAD queue)
+{
+    struct blocoTCD *B = alocar_bloco(&queue->opcoes);
+    if (B == NULL)
+        return NULL;
+
+    B->proximo = queue->blocos;
+    queue->blocos = B;
+
+    size_t ncelulas = (B->tamanho - sizeof(struct blocoTCD))
+                      / sizeof(struct celulaTCD);
+    for (size_t i = ncelulas - 1; i > 0; i--)
+        devolver_celula(queue, &B->celulas[i]);
+
+    return &B->celulas[0];
+}
+
+/**
+ * Função: ALOCAR_BLOCO
+ * Uso: bloco = alocar_bloco(&opcoes);
+ * -----------------------------------
+ * Aloca um bloco de células de acordo com as "opcoes". Com as opções padrão o
+ * bloco é alocado com malloc. Caso contrário (apenas no Linux) o bloco é
+ * mapeado com mmap, alinhado ao tamanho de página enorme, tentando, em ordem:
+ * páginas enormes explícitas (MAP_HUGETLB), páginas transparentes (madvise com
+ * MADV_HUGEPAGE) e páginas normais; se um nó NUMA foi pedido, o bloco é
+ * vinculado a ele com mbind antes de ser tocado. Falhas em páginas enormes ou
+ * em mbind não são erros: o bloco simplesmente fica sem essas otimizações.
+ * Retorna NULL apenas se não houver memória.
+ */
+
+static struct blocoTCD *
+alocar_bloco (const queue_opcoes *opcoes)
+{
+    struct blocoTCD *B = NULL;
+
+#ifdef __linux__
+    if (opcoes->paginas != QUEUE_PAGINAS_NORMAIS
+        || opcoes->vincular_numa)
+    {
+        size_t tamanho = opcoes->paginas == QUEUE_PAGINAS_NORMAIS
+                         ? TAM_BLOCO : TAM_PAGINA_ENORME;
+        void *p = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        if (opcoes->paginas == QUEUE_PAGINAS_EXPLICITAS)
+            p = mmap(NULL, tamanho, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+
+        if (p == MAP_FAILED)
+        {
+            /* Mapeia com folga para alinhar o bloco ao tamanho de página
+               enorme, e devolve as sobras ao sistema. */
+            size_t folga = tamanho == TAM_PAGINA_ENORME ? TAM_PAGINA_ENORME : 0;
+            char *q = mmap(NULL, tamanho + folga, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (q != MAP_FAILED)
+            {
+                uintptr_t inicio = (uintptr_t) q;
+                uintptr_t alinhado = folga == 0 ? inicio
+                    : (inicio + folga - 1) & ~((uintptr_t) folga - 1);
+                if (alinhado > inicio)
+                    munmap(q, alinhado - inicio);
+                if (inicio + folga > alinhado)
+                    munmap((char *) alinhado + tamanho,
+                           inicio + folga - alinhado);
+                p = (void *) alinhado;
+#ifdef MADV_HUGEPAGE
+                if (opcoes->paginas != QUEUE_PAGINAS_NORMAIS)
+                    madvise(p, tamanho, MADV_HUGEPAGE);
+#endif
+            }
+        }
+
+        if (p != MAP_FAILED)
+        {
+#ifdef SYS_mbind
+            if (opcoes->vincular_numa && opcoes->no_numa >= 0
+                && (size_t) opcoes->no_numa < sizeof(unsigned long) * 8)
+            {
+                unsigned long mascara = 1UL << opcoes->no_numa;
+                syscall(SYS_mbind, p, tamanho, MPOL_BIND_LSE, &mascara,
+                        sizeof(mascara) * 8 + 1, 0);
+            }
+#endif
+            B = p;
+            B->tamanho = tamanho;
+            B->mapeado = true;
+            return B;
+        }
+    }
+#endif
+
+    B = malloc(TAM_BLOCO);
+    if (B == NULL)
+        return NULL;
+
+    B->tamanho = TAM_BLOCO;
+    B->mapeado = false;
+    return B;
+}
+
+/**
+ * Função: LIBERAR_BLOCO
+ * Uso: liberar_bloco(bloco);
+ * --------------------------
+ * Devolve ao sistema a memória de um bloco alocado por "alocar_bloco".
+ */
+
+static void
+liberar_bloco (struct blocoTCD *bloco)
+{
+#ifdef __linux__
+    if (bloco->mapeado)
+    {
+        munmap(bloco, bloco->tamanho);
+        return;
+    }
+#endif
+    free(bloco);
+}
+
+/**
+ * Função: BALDE_DA_CHAVE
+ * Uso: balde = balde_da_chave(queue, chave);
+ * ------------------------------------------
+ * Retorna o índice do balde da "chave" no índice da "queue". A chave é
+ * espalhada (função de mistura do MurmurHash3) antes da máscara, para que
+ * chaves sequenciais não se concentrem nos mesmos baldes.
+ */
+
+static size_t
+balde_da_chave (const queueTAD queue, int chave)
+{
+    uint32_t h = (uint32_t) chave;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return (size_t) h & (queue->nbaldes - 1);
+}
+
+/**
+ * Função: BUSCAR_CHAVE
+ * Uso: balde = buscar_chave(queue, chave);
+ * ----------------------------------------
+ * Sonda o índice a partir do balde da "chave" e retorna o balde que contém a
+ * "chave" ou, se nenhuma célula pendente tiver essa chave, o primeiro balde
+ * vazio encontrado (onde a chave deve ser inserida). O índice nunca fica
+ * cheio, então sempre há um balde vazio.
+ */
+
+static size_t
+buscar_chave (const queueTAD queue, int chave)
+{
+    size_t mascara = queue->nbaldes - 1;
+    size_t b = balde_da_chave(queue, chave);
+    while (queue->indice[b].celula != NULL && queue->indice[b].chave != chave)
+        b = (b + 1) & mascara;
+    return b;
+}
+
+/**
+ * Função: DESINDEXAR_CHAVE
+ * Uso: desindexar_chave(queue, chave);
+ * ------------------------------------
+ * Retira a "chave" do índice da "queue". Para não deixar marcas de remoção, as
+ * entradas seguintes da mesma sequência de sondagem são deslocadas para trás
+ * quando o balde liberado fica entre o seu balde de origem e a sua posição.
+ */
+
+static void
+desindexar_chave (queueTAD queue, int chave)
+{
+    size_t mascara = queue->nbaldes - 1;
+    size_t i = buscar_chave(queue, chave);
+    if (queue->indice[i].celula == NULL)
+        return;
+
+    size_t j = i;
+    for (;;)
+    {
+        j = (j + 1) & mascara;
+        if (queue->indice[j].celula == NULL)
+            break;
+
+        size_t origem = balde_da_chave(queue, queue->indice[j].chave);
+        if (((j - origem) & mascara) >= ((j - i) & mascara))
+        {
+            queue->indice[i] = queue->indice[j];
+            i = j;
+        }
+    }
+
+    queue->indice[i].celula = NULL;
+    queue->nindexadas -= 1;
+}
+
+/**
+ * Função: REDIMENSIONAR_INDICE
+ * Uso: if (redimensionar_indice(queue)) . . .
+ * -------------------------------------------
+ * Dobra o número de baldes do índice e reinsere as entradas. Retorna true em
+ * caso de sucesso; se não houver memória, mantém o índice atual (que continua
+ * correto, apenas mais ocupado) e retorna false.
+ */
+
+static bool
+redimensionar_indice (queueTAD queue)
+{
+    struct entradaTCD *antigo = queue->indice;
+    size_t nantigo = queue->nbaldes;
+
+    struct entradaTCD *novo = calloc(nantigo * 2, sizeof(struct entradaTCD));
+    if (novo == NULL)
+        return false;
+
+    queue->indice = novo;
+    queue->nbaldes = nantigo * 2;
+    for (size_t i = 0; i < nantigo; i++)
+        if (antigo[i].celula != NULL)
+            novo[buscar_chave(queue, antigo[i].chave)] = antigo[i];
+
+    free(antigo);
+    return true;
+}
+
 /**
  * Função: PRIORITY_ENQUEUE
  * Uso: status = priority_enqueue(queue, elemento, prioridade);
@@ -401,7 +868,7 @@ remover_celula (celulaTAD *celula)
  * Os possíveis retornos são:
  *
  *     a) QUEUE_OK: operação realizada com sucesso;
- *     b) QUEUE_ERRO_QUEUE: queue inválida;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida ou criada no modo chaveado;
  *     c) QUEUE_ERRO_ARGUMENTO: elemento ou prioridade inválidos.
  */
 
@@ -409,9 +876,11 @@ queue_status
 priority_enqueue(queueTAD queue, const elementoT elemento, int prioridade) 
 {
     if (queue == NULL) return QUEUE_ERRO_QUEUE;      
+    if (queue->indice != NULL) return QUEUE_ERRO_QUEUE;
     if (elemento.valor == 0 && elemento.prioridade == 0) return QUEUE_ERRO_ARGUMENTO;
+    if (queue->classes != NULL) return enqueue_classe(queue, elemento, prioridade);
 
-    celulaTAD nova = criar_celula();
+    celulaTAD nova = criar_celula(queue);
     if (nova == NULL) return QUEUE_ERRO_ALOCACAO;  
 
     nova->elemento = elemento;  
@@ -449,3 +918,143 @@ priority_enqueue(queueTAD queue, const elementoT elemento, int prioridade)
     queue->nelem++;
     return QUEUE_OK;
 }
+
+/**
+ * Função: CONTADORES_CLASSE
+ * Uso: status = contadores_classe(queue, classe, &contadores);
+ * ------------------------------------------------------------
+ * Verifica se a queue tem classes de prioridade e se a classe existe, e copia
+ * os contadores da classe para "contadores". Retorna o queue_status apropriado.
+ */
+
+queue_status
+contadores_classe (const queueTAD queue, size_t classe,
+                   queue_contadores *contadores)
+{
+    if (queue == NULL || queue->classes == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (contadores == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+    else if (classe >= queue->nclasses)
+        return QUEUE_ERRO_POSICAO;
+
+    *contadores = queue->classes[classe].contadores;
+    return QUEUE_OK;
+}
+
+/**
+ * Função: CLASSE_DA_PRIORIDADE
+ * Uso: classe = classe_da_prioridade(queue, prioridade);
+ * ------------------------------------------------------
+ * Retorna a classe correspondente à "prioridade": a própria prioridade,
+ * limitada ao intervalo de 0 até (nclasses - 1).
+ */
+
+static size_t
+classe_da_prioridade (const queueTAD queue, int prioridade)
+{
+    if (prioridade <= 0)
+        return 0;
+    else if ((size_t) prioridade >= queue->nclasses)
+        return queue->nclasses - 1;
+
+    return (size_t) prioridade;
+}
+
+/**
+ * Função: ENQUEUE_CLASSE
+ * Uso: status = enqueue_classe(queue, elemento, prioridade);
+ * ----------------------------------------------------------
+ * Enfileira o "elemento" no final da LSE da classe da "prioridade" e, se a
+ * classe estava vazia, coloca a classe no final da lista de classes ativas.
+ * Retorna o queue_status apropriado.
+ */
+
+static queue_status
+enqueue_classe (queueTAD queue, const elementoT elemento, int prioridade)
+{
+    struct classeTCD *C = &queue->classes[classe_da_prioridade(queue, prioridade)];
+
+    celulaTAD nova = criar_celula(queue);
+    if (nova == NULL)
+        return QUEUE_ERRO_ALOCACAO;
+
+    nova->elemento = elemento;
+
+    if (C->inicio == NULL)
+        C->inicio = nova;
+    else
+        C->fim->proximo = nova;
+    C->fim = nova;
+
+    if (!C->ativa)
+    {
+        C->ativa = true;
+        C->deficit = 0;
+        C->proxima_ativa = NULL;
+        if (queue->ativas_inicio == NULL)
+            queue->ativas_inicio = C;
+        else
+            queue->ativas_fim->proxima_ativa = C;
+        queue->ativas_fim = C;
+    }
+
+    C->contadores.enfileirados += 1;
+    C->contadores.pendentes += 1;
+    queue->nelem += 1;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: DEQUEUE_CLASSES
+ * Uso: status = dequeue_classes(queue, &elemento);
+ * ------------------------------------------------
+ * Deficit round robin com custo unitário por elemento: a primeira classe ativa
+ * recebe o seu peso como "deficit" ao começar a sua vez, e entrega um elemento
+ * por chamada enquanto tiver deficit. Quando o deficit acaba, a classe vai
+ * para o final da lista de ativas; quando a classe esvazia, sai da lista (e
+ * perde o deficit restante). Como todo peso é pelo menos 1, cada chamada
+ * entrega um elemento em tempo O(1). A fila não pode estar vazia.
+ */
+
+static queue_status
+dequeue_classes (queueTAD queue, elementoT *elemento)
+{
+    struct classeTCD *C = queue->ativas_inicio;
+
+    if (C->deficit <= 0)
+        C->deficit = C->contadores.peso;
+
+    celulaTAD temp = C->inicio;
+    *elemento = temp->elemento;
+    C->inicio = temp->proximo;
+    C->deficit -= 1;
+
+    if (C->inicio == NULL)
+    {
+        C->fim = NULL;
+        C->ativa = false;
+        C->deficit = 0;
+        queue->ativas_inicio = C->proxima_ativa;
+        if (queue->ativas_inicio == NULL)
+            queue->ativas_fim = NULL;
+        C->proxima_ativa = NULL;
+    }
+    else if (C->deficit == 0 && C->proxima_ativa != NULL)
+    {
+        queue->ativas_inicio = C->proxima_ativa;
+        C->proxima_ativa = NULL;
+        queue->ativas_fim->proxima_ativa = C;
+        queue->ativas_fim = C;
+    }
+
+    if (remover_celula(queue, &temp) != CELULA_OK)
+        return QUEUE_ERRO_ALOCACAO;
+
+    C->contadores.desenfileirados += 1;
+    C->contadores.pendentes -= 1;
+    queue->nelem -= 1;
+
+    return QUEUE_OK;
+}
@@ -0,0 +1,278 @@
+/**
+ * Arquivo: queueTAD_lse_rapido.h
+ * Versão : 1.0
+ * Data   : 2026-10-18 18:00
+ * -------------------------
+ * Este arquivo define a representação concreta da fila implementada em
+ * queueTAD_lse.c (lista simplesmente encadeada) e um conjunto de funções
+ * "static inline" de CAMINHO RÁPIDO, sem verificação de argumentos, para
+ * clientes que garantem que a fila e os ponteiros informados são válidos.
+ *
+ * Como as funções são definidas no próprio cabeçalho, o compilador pode
+ * expandi-las no ponto de chamada e otimizar laços de enfileiramento e
+ * desenfileiramento sem cruzar a fronteira da unidade de tradução. A interface
+ * verificada (queueTAD.h) continua disponível e deve ser a escolha padrão; use
+ * este arquivo apenas quando as pré-condições de cada função forem garantidas
+ * pelo próprio cliente.
+ *
+ * ATENÇÃO: incluir este arquivo expõe a estrutura interna da fila. O cliente
+ * NÃO deve manipular os campos diretamente, apenas através das funções.
+ */
+
+/*** Inicia Boilerplate da Interface ***/
+
+#ifndef _QUEUETAD_LSE_RAPIDO_H
+#define _QUEUETAD_LSE_RAPIDO_H
+
+/*** Includes ***/
+
+#include "queueTAD.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/*** Tipos de Dados ***/
+
+/**
+ * Tipo: struct celulaTCD
+ * ----------------------
+ * Define uma célula (nó) da lista encadeada simples (LSE) que implementará a
+ * fila. O tipo concreto é o "celulaTCD"; também é criado um tipo "abstrato" com
+ * o nome de "celulaTAD" (na verdade não é um tipo abstrato real, pois a
+ * implementação concreta está visível, mas isso simplificará a implementação).
+ */
+
+struct celulaTCD
+{
+    elementoT elemento;
+    struct celulaTCD *proximo;
+};
+
+typedef struct celulaTCD *celulaTAD;
+
+/**
+ * Tipo: struct blocoTCD
+ * ---------------------
+ * Nas filas criadas com opções de alocação ("paginas", "vincular_numa" ou
+ * "celulas_iniciais" diferentes do padrão), as células não são alocadas uma a
+ * uma: a fila obtém do sistema BLOCOS de memória contíguos (possivelmente em
+ * páginas enormes e vinculados a um nó NUMA) que são divididos em células. As
+ * células livres ficam numa lista de reuso da própria fila e os blocos só são
+ * devolvidos ao sistema em "remover_queue", que percorre apenas os blocos (e
+ * não cada célula). Nas filas com as opções padrão, cada célula é alocada e
+ * liberada individualmente, como antes.
+ */
+
+struct blocoTCD
+{
+    struct blocoTCD *proximo;
+    size_t tamanho;
+    bool mapeado;
+    struct celulaTCD celulas[];
+};
+
+/**
+ * Tipo: struct classeTCD
+ * ----------------------
+ * Uma classe de prioridade das filas criadas com "num_classes": a sua própria
+ * LSE ("inicio"/"fim"), o seu peso e "deficit" (quantos elementos ainda pode
+ * entregar na rodada atual) e os seus contadores. As classes não vazias ficam
+ * numa lista de classes ativas, encadeada por "proxima_ativa", na ordem em que
+ * serão servidas.
+ */
+
+struct classeTCD
+{
+    celulaTAD inicio;
+    celulaTAD fim;
+    int deficit;
+    bool ativa;
+    struct classeTCD *proxima_ativa;
+    queue_contadores contadores;
+};
+
+/**
+ * Tipo: struct queueTCD
+ * ---------------------
+ * Este tipo define a representação concreta da fila. Esta implementação utiliza
+ * uma lista simplesmente encadeada (LSE) para armazenar so dados, e contém
+ * apenas os ponteiros "início" e "fim" da lista. Como a implementaçao é através
+ * de uma LSE, a lista é considerada dinâmica e não tem tamanho máximo definido.
+ * O número de elementos atualmente na fila também é armazenado para facilitar
+ * a consulta dessa informação. Nesta implementação:
+ *
+ *     a) O próximo elemento a ser enfileirado será colocado após a última
+ *        célula da lista, apontada pelo ponteiro "fim"; e
+ *     b) O próximo elemento a ser desenfileirado será a primeira célula da
+ *        lista, apontada pelo ponteiro "inicio".
+ *
+ * Se "em_blocos" for true, as células vêm da lista de células livres
+ * "livres", reabastecida a partir de novos blocos (lista "blocos") alocados
+ * conforme "opcoes"; caso contrário, vêm diretamente de malloc.
+ *
+ * No modo chaveado, "indice" é uma tabela de hash de endereçamento aberto com
+ * "nbaldes" baldes (sempre uma potência de 2), definida em queueTAD_lse.c, que
+ * associa a chave de cada uma das "nindexadas" células pendentes à célula.
+ * Nos demais modos, "indice" é NULL.
+ *
+ * Nas filas com classes de prioridade, "inicio" e "fim" não são usados: os
+ * elementos ficam nas "nclasses" LSEs de "classes", e "ativas_inicio" e
+ * "ativas_fim" delimitam a lista de classes ativas. Nos demais modos,
+ * "classes" é NULL.
+ */
+
+struct queueTCD
+{
+    celulaTAD inicio;
+    celulaTAD fim;
+    size_t nelem;
+    celulaTAD livres;
+    struct blocoTCD *blocos;
+    bool em_blocos;
+    queue_opcoes opcoes;
+    struct entradaTCD *indice;
+    size_t nbaldes;
+    size_t nindexadas;
+    struct classeTCD *classes;
+    size_t nclasses;
+    struct classeTCD *ativas_inicio;
+    struct classeTCD *ativas_fim;
+};
+
+/*** Declarações de Subprogramas Internos ***/
+
+/**
+ * Função: QUEUE_LSE_NOVO_BLOCO
+ * Uso: celula = queue_lse_novo_bloco(queue);
+ * ------------------------------------------
+ * Caminho lento da alocação de células, definido em queueTAD_lse.c: aloca um
+ * novo bloco, coloca suas células na lista de livres e retorna uma delas, ou
+ * NULL em caso de erro. Não deve ser chamada diretamente pelos clientes.
+ */
+
+celulaTAD
+queue_lse_novo_bloco (queueTAD queue);
+
+/*** Definições de Subprogramas Internos ***/
+
+/**
+ * Função: OBTER_CELULA
+ * Uso: celula = obter_celula(queue);
+ * ----------------------------------
+ * Aloca uma célula com malloc ou, nas filas em blocos, retira uma célula da
+ * lista de livres da fila (alocando um novo bloco, se não houver nenhuma).
+ * Retorna NULL em caso de erro de alocação.
+ */
+
+static inline celulaTAD
+obter_celula (queueTAD queue)
+{
+    if (!queue->em_blocos)
+        return malloc(sizeof(struct celulaTCD));
+
+    celulaTAD C = queue->livres;
+    if (C == NULL)
+        return queue_lse_novo_bloco(queue);
+
+    queue->livres = C->proximo;
+    return C;
+}
+
+/**
+ * Função: DEVOLVER_CELULA
+ * Uso: devolver_celula(queue, celula);
+ * ------------------------------------
+ * Libera a "celula" com free ou, nas filas em blocos, devolve a célula para a
+ * lista de livres da fila, para reuso.
+ */
+
+static inline void
+devolver_celula (queueTAD queue, celulaTAD celula)
+{
+    if (!queue->em_blocos)
+    {
+        free(celula);
+        return;
+    }
+
+    celula->proximo = queue->livres;
+    queue->livres = celula;
+}
+
+/*** Definições de Subprogramas de Caminho Rápido ***/
+
+/**
+ * Função: ENQUEUE_RAPIDO
+ * Uso: status = enqueue_rapido(queue, elemento);
+ * ----------------------------------------------
+ * Equivalente a "enqueue", mas sem verificar a validade da "queue". O cliente
+ * DEVE garantir que "queue" é uma fila válida criada por "criar_queue" ou por
+ * "criar_queue_opcoes". A única falha possível é a de alocação de célula:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso; e
+ *     b) QUEUE_ERRO_ALOCACAO: não foi possível alocar a nova célula.
+ *
+ * Filas com classes de prioridade ou no modo chaveado usam o "enqueue"
+ * verificado (que, no modo chaveado, retorna QUEUE_ERRO_QUEUE).
+ */
+
+static inline queue_status
+enqueue_rapido (queueTAD queue, const elementoT elemento)
+{
+    if (queue->classes != NULL || queue->indice != NULL)
+        return enqueue(queue, elemento);
+
+    celulaTAD nova = obter_celula(queue);
+    if (nova == NULL)
+        return QUEUE_ERRO_ALOCACAO;
+
+    nova->elemento = elemento;
+    nova->proximo = NULL;
+
+    if (queue->inicio == NULL)
+        queue->inicio = nova;
+    else
+        queue->fim->proximo = nova;
+    queue->fim = nova;
+    queue->nelem += 1;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: DEQUEUE_RAPIDO
+ * Uso: elemento = dequeue_rapido(queue);
+ * --------------------------------------
+ * Equivalente a "dequeue", mas sem nenhuma verificação: desenfileira e retorna
+ * o elemento no início da fila. O cliente DEVE garantir que "queue" é uma fila
+ * válida e que NÃO está vazia (por exemplo, consultando "num_elementos" uma
+ * única vez antes de um laço); caso contrário o comportamento é indefinido.
+ * Filas no modo chaveado ou com classes de prioridade usam o "dequeue"
+ * verificado.
+ */
+
+static inline elementoT
+dequeue_rapido (queueTAD queue)
+{
+    if (queue->indice != NULL || queue->classes != NULL)
+    {
+        elementoT elemento;
+        dequeue(queue, &elemento);
+        return elemento;
+    }
+
+    celulaTAD temp = queue->inicio;
+    elementoT elemento = temp->elemento;
+
+    queue->inicio = temp->proximo;
+    if (queue->inicio == NULL)
+        queue->fim = NULL;
+    queue->nelem -= 1;
+
+    devolver_celula(queue, temp);
+    return elemento;
+}
+
+/*** Finaliza Boilerplate da Interface ***/
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * Arquivo: shm_queueTAD.h
+ * Versão : 1.0
+ * Data   : 2026-10-18 19:10
+ * -------------------------
+ * Este arquivo define a interface shm_queueTAD.h, uma FILA COMPARTILHADA ENTRE
+ * PROCESSOS, de tamanho fixo, cujos elementos são do tipo elementoT (definido
+ * em queueTAD.h). A fila reside num segmento de memória compartilhada POSIX
+ * identificado por um nome (por exemplo, "/minha_fila"): um processo cria a
+ * fila com "criar_queue_compartilhada" e os demais a abrem, pelo mesmo nome,
+ * com "abrir_queue_compartilhada".
+ *
+ * Qualquer processo (e qualquer thread) pode enfileirar e desenfileirar ao
+ * mesmo tempo. Enquanto a fila não está vazia nem cheia, as operações não fazem
+ * chamadas de sistema; as versões "_esperar" bloqueiam o processo quando a fila
+ * está vazia (ou cheia) e são acordadas pelo outro lado através de futexes.
+ *
+ * Esta interface só está disponível no Linux (shm_open, mmap e futex); em
+ * versões antigas da glibc é preciso ligar o programa com -lrt.
+ */
+
+/*** Inicia Boilerplate da Interface ***/
+
+#ifndef _SHM_QUEUETAD_H
+#define _SHM_QUEUETAD_H
+
+/*** Includes ***/
+
+#include "queueTAD.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*** Tipos de Dados ***/
+
+/**
+ * Tipo abstrato: shm_queueTAD
+ * ---------------------------
+ * O tipo "shm_queueTAD" representa, em cada processo, o acesso a uma fila
+ * compartilhada. É definido como um ponteiro para shm_queueTCD, que está
+ * disponível apenas para a implementação, não para os clientes. Cada processo
+ * tem o seu próprio shm_queueTAD, mas todos enxergam a mesma fila.
+ */
+
+typedef struct shm_queueTCD *shm_queueTAD;
+
+/*** Declarações de Subprogramas ***/
+
+/**
+ * Função: CRIAR_QUEUE_COMPARTILHADA
+ * Uso: queue = criar_queue_compartilhada(nome, capacidade);
+ * ---------------------------------------------------------
+ * Cria o segmento de memória compartilhada "nome" e nele uma fila vazia com
+ * espaço para pelo menos "capacidade" elementos (a capacidade é arredondada
+ * para a próxima potência de 2). Falha se já existir um segmento com o mesmo
+ * nome. Retorna o acesso à fila, ou NULL em caso de erro.
+ */
+
+shm_queueTAD
+criar_queue_compartilhada (const char *nome, size_t capacidade);
+
+/**
+ * Função: ABRIR_QUEUE_COMPARTILHADA
+ * Uso: queue = abrir_queue_compartilhada(nome);
+ * ---------------------------------------------
+ * Abre uma fila já criada (e inicializada) por "criar_queue_compartilhada" em
+ * outro processo. Retorna o acesso à fila, ou NULL se o segmento não existir,
+ * não contiver uma fila válida ou ainda não tiver sido inicializado.
+ */
+
+shm_queueTAD
+abrir_queue_compartilhada (const char *nome);
+
+/**
+ * Função: REMOVER_QUEUE_COMPARTILHADA
+ * Uso: status = remover_queue_compartilhada(&queue);
+ * --------------------------------------------------
+ * Encerra o acesso deste processo à fila (a fila continua existindo para os
+ * demais processos). Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso (o ponteiro "queue" informado
+ *        será direcionado para NULL);
+ *     b) QUEUE_ERRO_ARGUMENTO: ponteiro passado como argumento não é válido; e
+ *     c) QUEUE_ERRO_QUEUE: queue inválida.
+ */
+
+queue_status
+remover_queue_compartilhada (shm_queueTAD *queue);
+
+/**
+ * Função: APAGAR_QUEUE_COMPARTILHADA
+ * Uso: status = apagar_queue_compartilhada(nome);
+ * -----------------------------------------------
+ * Remove o nome "nome" do sistema: novos "abrir_queue_compartilhada" falham, e
+ * a memória é liberada quando o último processo chamar
+ * "remover_queue_compartilhada". Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso; e
+ *     b) QUEUE_ERRO_ARGUMENTO: nome inválido ou inexistente.
+ */
+
+queue_status
+apagar_queue_compartilhada (const char *nome);
+
+/**
+ * Função: ENQUEUE_COMPARTILHADA
+ * Uso: status = enqueue_compartilhada(queue, elemento);
+ * -----------------------------------------------------
+ * Enfileira o "elemento" no final da fila, sem bloquear. Os possíveis retornos
+ * são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida; e
+ *     c) QUEUE_ERRO_CHEIA: fila cheia.
+ */
+
+queue_status
+enqueue_compartilhada (shm_queueTAD queue, const elementoT elemento);
+
+/**
+ * Função: ENQUEUE_COMPARTILHADA_ESPERAR
+ * Uso: status = enqueue_compartilhada_esperar(queue, elemento);
+ * -------------------------------------------------------------
+ * Como "enqueue_compartilhada", mas se a fila estiver cheia bloqueia até que
+ * algum processo desenfileire. Os possíveis retornos são QUEUE_OK e
+ * QUEUE_ERRO_QUEUE (queue inválida).
+ */
+
+queue_status
+enqueue_compartilhada_esperar (shm_queueTAD queue, const elementoT elemento);
+
+/**
+ * Função: DEQUEUE_COMPARTILHADA
+ * Uso: status = dequeue_compartilhada(queue, &elemento);
+ * ------------------------------------------------------
+ * Desenfileira o elemento no início da fila, sem bloquear, e o coloca no
+ * endereço apontado por "elemento". Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_QUEUE: queue inválida;
+ *     c) QUEUE_ERRO_ARGUMENTO: ponteiro elemento inválido; e
+ *     d) QUEUE_ERRO_VAZIA: queue vazia.
+ *
+ * O valor armazenado no local apontado por "elemento" só é válido e confiável
+ * se a função tiver retornado QUEUE_OK.
+ */
+
+queue_status
+dequeue_compartilhada (shm_queueTAD queue, elementoT *elemento);
+
+/**
+ * Função: DEQUEUE_COMPARTILHADA_ESPERAR
+ * Uso: status = dequeue_compartilhada_esperar(queue, &elemento);
+ * --------------------------------------------------------------
+ * Como "dequeue_compartilhada", mas se a fila estiver vazia bloqueia até que
+ * algum processo enfileire. Os possíveis retornos são QUEUE_OK,
+ * QUEUE_ERRO_QUEUE e QUEUE_ERRO_ARGUMENTO.
+ */
+
+queue_status
+dequeue_compartilhada_esperar (shm_queueTAD queue, elementoT *elemento);
+
+/**
+ * Função: NUM_ELEMENTOS_COMPARTILHADA
+ * Uso: status = num_elementos_compartilhada(queue, &nelem);
+ * ---------------------------------------------------------
+ * Armazena em "nelem" a quantidade de elementos na fila. Como outros processos
+ * podem estar operando ao mesmo tempo, o valor é apenas uma fotografia do
+ * momento da consulta. Os possíveis retornos são:
+ *
+ *     a) QUEUE_OK: operação realizada com sucesso;
+ *     b) QUEUE_ERRO_ARGUMENTO: ponteiro "nelem" inválido; e
+ *     c) QUEUE_ERRO_QUEUE: queue inválida.
+ */
+
+queue_status
+num_elementos_compartilhada (const shm_queueTAD queue, size_t *nelem);
+
+/*** Finaliza Boilerplate da Interface ***/
+
+#endif
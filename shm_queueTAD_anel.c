@@ -0,0 +1,531 @@
+/**
+ * Arquivo: shm_queueTAD_anel.c
+ * Versão : 1.0
+ * Data   : 2026-10-18 19:10
+ * -------------------------
+ * Este arquivo implementa a interface shm_queueTAD.h através de um buffer
+ * circular (anel) de tamanho fixo dentro de um segmento de memória
+ * compartilhada POSIX. Como cada processo mapeia o segmento num endereço
+ * diferente, o segmento não contém ponteiros: as posições são guardadas como
+ * deslocamentos a partir do início do segmento.
+ *
+ * O anel segue o algoritmo de fila limitada com múltiplos produtores e
+ * consumidores de Dmitry Vyukov: cada posição tem um número de sequência que
+ * indica se está livre para o produtor ou pronta para o consumidor da "volta"
+ * atual, de modo que enfileirar e desenfileirar exigem apenas operações
+ * atômicas, sem travas nem chamadas de sistema. Futexes só são usados para
+ * bloquear (e acordar) processos nas versões "_esperar".
+ */
+
+/*** Includes ***/
+
+#define _GNU_SOURCE
+
+#include "shm_queueTAD.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*** Constantes Simbólicas ***/
+
+/**
+ * Constantes: MAGICA, TAM_LINHA_CACHE, CAPACIDADE_MAXIMA, MAX_OFF_T
+ * -----------------------------------------------------------------
+ * MAGICA identifica um segmento que contém uma fila já inicializada. Os
+ * contadores de produtores e consumidores ficam em linhas de cache distintas
+ * (de TAM_LINHA_CACHE bytes) para que não disputem a mesma linha. A capacidade
+ * pedida é limitada a CAPACIDADE_MAXIMA posições, e o tamanho do segmento deve
+ * caber em off_t, cujo maior valor é MAX_OFF_T.
+ */
+
+#define MAGICA            0x51554555u
+#define TAM_LINHA_CACHE   64
+#define CAPACIDADE_MAXIMA ((uint64_t) 1 << 40)
+#define MAX_OFF_T         ((uint64_t) ((((off_t) 1 << (sizeof(off_t) \
+                                           * CHAR_BIT - 2)) - 1) * 2 + 1))
+
+/*** Tipos de Dados ***/
+
+/**
+ * Tipo: struct posicaoTCD
+ * -----------------------
+ * Uma posição do anel: o elemento e o seu número de sequência. Na volta "v" do
+ * anel, a posição "i" está livre para o produtor quando a sequência vale
+ * "v * capacidade + i", e pronta para o consumidor quando vale esse número
+ * mais 1.
+ */
+
+struct posicaoTCD
+{
+    _Atomic uint64_t sequencia;
+    elementoT elemento;
+};
+
+/**
+ * Tipo: struct segmentoTCD
+ * ------------------------
+ * Cabeçalho do segmento compartilhado. As posições do anel começam
+ * "deslocamento" bytes após o início do cabeçalho. "cauda" é o próximo índice
+ * a ser enfileirado e "cabeca" o próximo a ser desenfileirado (ambos crescem
+ * indefinidamente; a posição no anel é o índice módulo a capacidade).
+ *
+ * "itens" e "espacos" são as palavras de futex onde esperam os consumidores
+ * (fila vazia) e os produtores (fila cheia); "esperando_itens" e
+ * "esperando_espacos" contam os processos bloqueados, para que o outro lado só
+ * faça a chamada de sistema de acordar quando houver alguém esperando.
+ */
+
+struct segmentoTCD
+{
+    _Atomic uint32_t magica;
+    uint32_t tamanho_elemento;
+    uint64_t capacidade;
+    uint64_t deslocamento;
+    _Alignas(TAM_LINHA_CACHE) _Atomic uint64_t cauda;
+    _Alignas(TAM_LINHA_CACHE) _Atomic uint64_t cabeca;
+    _Alignas(TAM_LINHA_CACHE) _Atomic uint32_t itens;
+    _Atomic uint32_t esperando_itens;
+    _Alignas(TAM_LINHA_CACHE) _Atomic uint32_t espacos;
+    _Atomic uint32_t esperando_espacos;
+};
+
+/**
+ * Tipo: struct shm_queueTCD
+ * -------------------------
+ * Acesso local (de um processo) à fila: o endereço onde o segmento foi mapeado
+ * neste processo, o endereço das posições do anel e o tamanho do mapeamento.
+ */
+
+struct shm_queueTCD
+{
+    struct segmentoTCD *segmento;
+    struct posicaoTCD *posicoes;
+    uint64_t mascara;
+    size_t tamanho;
+};
+
+/*** Declarações de Suprogramas Privados ***/
+
+static shm_queueTAD mapear (int fd, size_t tamanho);
+static void aguardar (_Atomic uint32_t *palavra, uint32_t valor);
+static void acordar (_Atomic uint32_t *palavra, _Atomic uint32_t *esperando);
+
+/*** Definições de Subprogramas Exportados ***/
+
+/**
+ * Função: CRIAR_QUEUE_COMPARTILHADA
+ * Uso: queue = criar_queue_compartilhada(nome, capacidade);
+ * ---------------------------------------------------------
+ * Calcula o tamanho do segmento em 64 bits e confere se ele cabe em size_t e
+ * em off_t. Cria e dimensiona o segmento, inicializa o cabeçalho e as
+ * sequências das posições e, por último, publica a MAGICA, para que "abrir" só
+ * aceite filas completamente inicializadas. Retorna NULL em caso de erro.
+ */
+
+shm_queueTAD
+criar_queue_compartilhada (const char *nome, size_t capacidade)
+{
+    if (nome == NULL || capacidade == 0
+        || (uint64_t) capacidade > CAPACIDADE_MAXIMA)
+        return NULL;
+
+    uint64_t cap = 1;
+    while (cap < capacidade)
+        cap <<= 1;
+
+    uint64_t deslocamento = (sizeof(struct segmentoTCD) + TAM_LINHA_CACHE - 1)
+                            & ~(uint64_t) (TAM_LINHA_CACHE - 1);
+    uint64_t total = deslocamento + cap * sizeof(struct posicaoTCD);
+    if (total > SIZE_MAX || total > MAX_OFF_T)
+        return NULL;
+    size_t tamanho = (size_t) total;
+
+    int fd = shm_open(nome, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+        return NULL;
+
+    if (ftruncate(fd, (off_t) tamanho) != 0)
+    {
+        close(fd);
+        shm_unlink(nome);
+        return NULL;
+    }
+
+    shm_queueTAD Q = mapear(fd, tamanho);
+    close(fd);
+    if (Q == NULL)
+    {
+        shm_unlink(nome);
+        return NULL;
+    }
+
+    struct segmentoTCD *S = Q->segmento;
+    S->tamanho_elemento = sizeof(elementoT);
+    S->capacidade = cap;
+    S->deslocamento = deslocamento;
+    atomic_init(&S->cauda, 0);
+    atomic_init(&S->cabeca, 0);
+    atomic_init(&S->itens, 0);
+    atomic_init(&S->esperando_itens, 0);
+    atomic_init(&S->espacos, 0);
+    atomic_init(&S->esperando_espacos, 0);
+
+    Q->posicoes = (struct posicaoTCD *) ((char *) S + deslocamento);
+    Q->mascara = cap - 1;
+    for (uint64_t i = 0; i < cap; i++)
+        atomic_init(&Q->posicoes[i].sequencia, i);
+
+    atomic_store_explicit(&S->magica, MAGICA, memory_order_release);
+    return Q;
+}
+
+/**
+ * Função: ABRIR_QUEUE_COMPARTILHADA
+ * Uso: queue = abrir_queue_compartilhada(nome);
+ * ---------------------------------------------
+ * Abre e mapeia o segmento e lê a MAGICA com "acquire" ANTES de qualquer outro
+ * campo do cabeçalho: se ela ainda não foi publicada, o criador pode estar
+ * escrevendo o cabeçalho, e a fila é rejeitada sem lê-lo. Só então confere o
+ * tamanho do elemento, a capacidade (potência de 2 não nula) e se o anel cabe
+ * no segmento (sem estouro aritmético). Retorna NULL em caso de erro.
+ */
+
+shm_queueTAD
+abrir_queue_compartilhada (const char *nome)
+{
+    if (nome == NULL)
+        return NULL;
+
+    int fd = shm_open(nome, O_RDWR, 0);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(struct segmentoTCD))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    shm_queueTAD Q = mapear(fd, (size_t) st.st_size);
+    close(fd);
+    if (Q == NULL)
+        return NULL;
+
+    struct segmentoTCD *S = Q->segmento;
+    if (atomic_load_explicit(&S->magica, memory_order_acquire) != MAGICA)
+    {
+        remover_queue_compartilhada(&Q);
+        return NULL;
+    }
+
+    uint64_t cap = S->capacidade;
+    uint64_t deslocamento = S->deslocamento;
+    if (S->tamanho_elemento != sizeof(elementoT)
+        || cap == 0 || (cap & (cap - 1)) != 0
+        || deslocamento < sizeof(struct segmentoTCD)
+        || deslocamento % TAM_LINHA_CACHE != 0
+        || deslocamento > Q->tamanho
+        || cap > (Q->tamanho - deslocamento) / sizeof(struct posicaoTCD))
+    {
+        remover_queue_compartilhada(&Q);
+        return NULL;
+    }
+
+    Q->posicoes = (struct posicaoTCD *) ((char *) S + deslocamento);
+    Q->mascara = cap - 1;
+    return Q;
+}
+
+/**
+ * Função: REMOVER_QUEUE_COMPARTILHADA
+ * Uso: status = remover_queue_compartilhada(&queue);
+ * --------------------------------------------------
+ * Desfaz o mapeamento do segmento neste processo e libera o acesso local.
+ * Retorna queue_status apropriado.
+ */
+
+queue_status
+remover_queue_compartilhada (shm_queueTAD *queue)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+    else if (*queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+
+    munmap((*queue)->segmento, (*queue)->tamanho);
+    free(*queue);
+    *queue = NULL;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: APAGAR_QUEUE_COMPARTILHADA
+ * Uso: status = apagar_queue_compartilhada(nome);
+ * -----------------------------------------------
+ * Remove o nome do segmento com shm_unlink. Retorna queue_status apropriado.
+ */
+
+queue_status
+apagar_queue_compartilhada (const char *nome)
+{
+    if (nome == NULL || shm_unlink(nome) != 0)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    return QUEUE_OK;
+}
+
+/**
+ * Função: ENQUEUE_COMPARTILHADA
+ * Uso: status = enqueue_compartilhada(queue, elemento);
+ * -----------------------------------------------------
+ * Reserva o índice "cauda" com compare-and-swap, desde que a posição
+ * correspondente esteja livre nesta volta, grava o elemento e publica a
+ * posição para os consumidores. Se houver consumidores bloqueados, acorda um.
+ * Retorna o queue_status apropriado.
+ */
+
+queue_status
+enqueue_compartilhada (shm_queueTAD queue, const elementoT elemento)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+
+    struct segmentoTCD *S = queue->segmento;
+    struct posicaoTCD *P;
+    uint64_t pos = atomic_load_explicit(&S->cauda, memory_order_relaxed);
+
+    for (;;)
+    {
+        P = &queue->posicoes[pos & queue->mascara];
+        uint64_t seq = atomic_load_explicit(&P->sequencia, memory_order_acquire);
+        int64_t dif = (int64_t) (seq - pos);
+
+        if (dif == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&S->cauda, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+            return QUEUE_ERRO_CHEIA;
+        else
+            pos = atomic_load_explicit(&S->cauda, memory_order_relaxed);
+    }
+
+    P->elemento = elemento;
+    atomic_store_explicit(&P->sequencia, pos + 1, memory_order_release);
+
+    acordar(&S->itens, &S->esperando_itens);
+    return QUEUE_OK;
+}
+
+/**
+ * Função: ENQUEUE_COMPARTILHADA_ESPERAR
+ * Uso: status = enqueue_compartilhada_esperar(queue, elemento);
+ * -------------------------------------------------------------
+ * Tenta enfileirar; enquanto a fila estiver cheia, registra-se como produtor
+ * bloqueado e dorme no futex "espacos". Retorna o queue_status apropriado.
+ */
+
+queue_status
+enqueue_compartilhada_esperar (shm_queueTAD queue, const elementoT elemento)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+
+    struct segmentoTCD *S = queue->segmento;
+    queue_status status = enqueue_compartilhada(queue, elemento);
+
+    while (status == QUEUE_ERRO_CHEIA)
+    {
+        atomic_fetch_add(&S->esperando_espacos, 1);
+        uint32_t valor = atomic_load(&S->espacos);
+        status = enqueue_compartilhada(queue, elemento);
+        if (status == QUEUE_ERRO_CHEIA)
+            aguardar(&S->espacos, valor);
+        atomic_fetch_sub(&S->esperando_espacos, 1);
+    }
+
+    return status;
+}
+
+/**
+ * Função: DEQUEUE_COMPARTILHADA
+ * Uso: status = dequeue_compartilhada(queue, &elemento);
+ * ------------------------------------------------------
+ * Reserva o índice "cabeca" com compare-and-swap, desde que a posição
+ * correspondente já tenha sido publicada nesta volta, lê o elemento e libera a
+ * posição para a próxima volta dos produtores. Se houver produtores
+ * bloqueados, acorda um. Retorna o queue_status apropriado.
+ */
+
+queue_status
+dequeue_compartilhada (shm_queueTAD queue, elementoT *elemento)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (elemento == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    struct segmentoTCD *S = queue->segmento;
+    struct posicaoTCD *P;
+    uint64_t pos = atomic_load_explicit(&S->cabeca, memory_order_relaxed);
+
+    for (;;)
+    {
+        P = &queue->posicoes[pos & queue->mascara];
+        uint64_t seq = atomic_load_explicit(&P->sequencia, memory_order_acquire);
+        int64_t dif = (int64_t) (seq - (pos + 1));
+
+        if (dif == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&S->cabeca, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+            return QUEUE_ERRO_VAZIA;
+        else
+            pos = atomic_load_explicit(&S->cabeca, memory_order_relaxed);
+    }
+
+    *elemento = P->elemento;
+    atomic_store_explicit(&P->sequencia, pos + queue->mascara + 1,
+                          memory_order_release);
+
+    acordar(&S->espacos, &S->esperando_espacos);
+    return QUEUE_OK;
+}
+
+/**
+ * Função: DEQUEUE_COMPARTILHADA_ESPERAR
+ * Uso: status = dequeue_compartilhada_esperar(queue, &elemento);
+ * --------------------------------------------------------------
+ * Tenta desenfileirar; enquanto a fila estiver vazia, registra-se como
+ * consumidor bloqueado e dorme no futex "itens". Retorna o queue_status
+ * apropriado.
+ */
+
+queue_status
+dequeue_compartilhada_esperar (shm_queueTAD queue, elementoT *elemento)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (elemento == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    struct segmentoTCD *S = queue->segmento;
+    queue_status status = dequeue_compartilhada(queue, elemento);
+
+    while (status == QUEUE_ERRO_VAZIA)
+    {
+        atomic_fetch_add(&S->esperando_itens, 1);
+        uint32_t valor = atomic_load(&S->itens);
+        status = dequeue_compartilhada(queue, elemento);
+        if (status == QUEUE_ERRO_VAZIA)
+            aguardar(&S->itens, valor);
+        atomic_fetch_sub(&S->esperando_itens, 1);
+    }
+
+    return status;
+}
+
+/**
+ * Função: NUM_ELEMENTOS_COMPARTILHADA
+ * Uso: status = num_elementos_compartilhada(queue, &nelem);
+ * ---------------------------------------------------------
+ * Calcula a quantidade de elementos pela diferença entre "cauda" e "cabeca".
+ */
+
+queue_status
+num_elementos_compartilhada (const shm_queueTAD queue, size_t *nelem)
+{
+    if (queue == NULL)
+        return QUEUE_ERRO_QUEUE;
+    else if (nelem == NULL)
+        return QUEUE_ERRO_ARGUMENTO;
+
+    uint64_t cabeca = atomic_load(&queue->segmento->cabeca);
+    uint64_t cauda = atomic_load(&queue->segmento->cauda);
+    *nelem = cauda > cabeca ? (size_t) (cauda - cabeca) : 0;
+    return QUEUE_OK;
+}
+
+/*** Definições de Subprogramas Privados ***/
+
+/**
+ * Função: MAPEAR
+ * Uso: queue = mapear(fd, tamanho);
+ * ---------------------------------
+ * Mapeia "tamanho" bytes do segmento "fd" neste processo e cria o acesso
+ * local. Retorna NULL em caso de erro.
+ */
+
+static shm_queueTAD
+mapear (int fd, size_t tamanho)
+{
+    shm_queueTAD Q = calloc(1, sizeof(struct shm_queueTCD));
+    if (Q == NULL)
+        return NULL;
+
+    void *p = mmap(NULL, tamanho, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+    {
+        free(Q);
+        return NULL;
+    }
+
+    Q->segmento = p;
+    Q->posicoes = NULL;
+    Q->mascara = 0;
+    Q->tamanho = tamanho;
+    return Q;
+}
+
+/**
+ * Função: AGUARDAR
+ * Uso: aguardar(&palavra, valor);
+ * -------------------------------
+ * Bloqueia o processo no futex "palavra" enquanto ela valer "valor". O futex
+ * não é privado (sem FUTEX_PRIVATE_FLAG), pois é compartilhado entre
+ * processos. Retornos antecipados (sinais, valor já alterado) são tratados
+ * pelo laço do chamador, que sempre tenta a operação de novo.
+ */
+
+static void
+aguardar (_Atomic uint32_t *palavra, uint32_t valor)
+{
+    syscall(SYS_futex, (uint32_t *) palavra, FUTEX_WAIT, valor, NULL, NULL, 0);
+}
+
+/**
+ * Função: ACORDAR
+ * Uso: acordar(&palavra, &esperando);
+ * -----------------------------------
+ * Se houver processos bloqueados na "palavra", altera o seu valor e acorda um
+ * deles. A barreira garante que quem está prestes a dormir ou enxerga a
+ * operação que acabou de ser publicada, ou enxerga a alteração da palavra (e
+ * não dorme), sem perder o aviso. Sem ninguém esperando, não há chamada de
+ * sistema.
+ */
+
+static void
+acordar (_Atomic uint32_t *palavra, _Atomic uint32_t *esperando)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(esperando, memory_order_relaxed) == 0)
+        return;
+
+    atomic_fetch_add(palavra, 1);
+    syscall(SYS_futex, (uint32_t *) palavra, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
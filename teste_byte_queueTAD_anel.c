@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "byte_queueTAD.h"
+
+int main()
+{
+    byte_queueTAD queue = criar_byte_queue(64);
+    if (queue == NULL)
+    {
+        printf("Erro ao criar a fila de bytes.\n");
+        return 1;
+    }
+
+    const char *mensagens[] = {"primeira", "segunda mensagem", "3"};
+
+    for (int i = 0; i < 3; i++)
+    {
+        size_t tamanho = strlen(mensagens[i]) + 1;
+        void *destino;
+
+        if (reservar(queue, tamanho, &destino) == QUEUE_OK)
+        {
+            memcpy(destino, mensagens[i], tamanho);
+            confirmar(queue);
+        }
+        else
+        {
+            printf("Sem espaço para: %s\n", mensagens[i]);
+        }
+    }
+
+    const void *dados;
+    size_t tamanho;
+
+    while (espiar(queue, &dados, &tamanho) == QUEUE_OK)
+    {
+        printf("Registro (%zu bytes): %s\n", tamanho, (const char *) dados);
+        liberar(queue);
+    }
+
+    /* O consumidor esvazia a fila enquanto há uma reserva pendente que deu a
+       volta no buffer: o registro confirmado deve ser lido corretamente. */
+    void *destino;
+    reservar(queue, 16, &destino);
+    confirmar(queue);
+    reservar(queue, 16, &destino);
+    confirmar(queue);
+    liberar(queue);
+    if (reservar(queue, 16, &destino) != QUEUE_OK)
+    {
+        printf("Erro ao reservar com a fila envolta.\n");
+        return 1;
+    }
+    liberar(queue);
+    strcpy(destino, "apos esvaziar");
+    confirmar(queue);
+
+    size_t nreg;
+    if (espiar(queue, &dados, &tamanho) != QUEUE_OK
+        || strcmp(dados, "apos esvaziar") != 0
+        || liberar(queue) != QUEUE_OK
+        || num_registros(queue, &nreg) != QUEUE_OK || nreg != 0)
+    {
+        printf("Erro: reserva confirmada após esvaziar a fila.\n");
+        return 1;
+    }
+    printf("Registro após esvaziar: apos esvaziar\n");
+
+    remover_byte_queue(&queue);
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "queueTAD.h"
+#include "queueTAD_lse_rapido.h"
 
 int main()
 {
@@ -36,6 +37,72 @@ int main()
         }
     } while (!esta_vazia);
 
+    for (int i = 1; i <= 3; i++)
+    {
+        elementoT e = {i * 100, 0};
+        enqueue_rapido(queue, e);
+    }
+
+    size_t nelem;
+    num_elementos(queue, &nelem);
+    for (size_t i = 0; i < nelem; i++)
+    {
+        elemento = dequeue_rapido(queue);
+        printf("Rapido -> Valor: %d\n", elemento.valor);
+    }
+
+    remover_queue(&queue);
+
+    queue_opcoes opcoes = {.paginas = QUEUE_PAGINAS_TRANSPARENTES,
+                           .celulas_iniciais = 1024,
+                           .chaveada = true};
+    queue = criar_queue_opcoes(&opcoes);
+    if (queue == NULL)
+    {
+        printf("Erro ao criar a fila com opções.\n");
+        return 1;
+    }
+
+    elementoT x2 = {10, 1};
+    enqueue_chave(queue, x);
+    enqueue_chave(queue, y);
+    enqueue_chave(queue, x2);
+
+    while (vazia(queue, &esta_vazia) == QUEUE_OK && !esta_vazia)
+        if (dequeue(queue, &elemento) == QUEUE_OK)
+            printf("Chave -> Valor: %d, Prioridade: %d\n",
+                   elemento.valor, elemento.prioridade);
+
+    remover_queue(&queue);
+
+    int pesos[] = {2, 1};
+    queue_opcoes classes = {.num_classes = 2,
+                            .pesos = pesos};
+    queue = criar_queue_opcoes(&classes);
+    if (queue == NULL)
+    {
+        printf("Erro ao criar a fila com classes.\n");
+        return 1;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        elementoT alta = {i, 0};
+        elementoT baixa = {100 + i, 1};
+        enqueue(queue, alta);
+        enqueue(queue, baixa);
+    }
+
+    while (vazia(queue, &esta_vazia) == QUEUE_OK && !esta_vazia)
+        if (dequeue(queue, &elemento) == QUEUE_OK)
+            printf("Classe %d -> Valor: %d\n", elemento.prioridade, elemento.valor);
+
+    queue_contadores contadores;
+    for (size_t c = 0; c < 2; c++)
+        if (contadores_classe(queue, c, &contadores) == QUEUE_OK)
+            printf("Classe %zu: peso %d, desenfileirados %zu\n",
+                   c, contadores.peso, contadores.desenfileirados);
+
     remover_queue(&queue);
 
     return 0;
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "shm_queueTAD.h"
+
+#define NOME "/teste_shm_queueTAD"
+#define TOTAL 100000
+
+int main()
+{
+    apagar_queue_compartilhada(NOME);
+
+    shm_queueTAD queue = criar_queue_compartilhada(NOME, 64);
+    if (queue == NULL)
+    {
+        printf("Erro ao criar a fila compartilhada.\n");
+        return 1;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        shm_queueTAD produtor = abrir_queue_compartilhada(NOME);
+        if (produtor == NULL)
+            _exit(1);
+
+        for (int i = 1; i <= TOTAL; i++)
+        {
+            elementoT e = {i, 0};
+            enqueue_compartilhada_esperar(produtor, e);
+        }
+
+        remover_queue_compartilhada(&produtor);
+        _exit(0);
+    }
+
+    if (pid < 0)
+    {
+        printf("Erro ao criar o processo produtor.\n");
+        remover_queue_compartilhada(&queue);
+        apagar_queue_compartilhada(NOME);
+        return 1;
+    }
+
+    long long soma = 0;
+    elementoT elemento;
+    int recebidos = 0, em_ordem = 1;
+
+    while (recebidos < TOTAL)
+    {
+        if (dequeue_compartilhada_esperar(queue, &elemento) != QUEUE_OK)
+        {
+            printf("Erro ao remover elemento da fila.\n");
+            break;
+        }
+        recebidos++;
+        if (elemento.valor != recebidos)
+            em_ordem = 0;
+        soma += elemento.valor;
+    }
+
+    int estado;
+    int filho_ok = waitpid(pid, &estado, 0) == pid
+                   && WIFEXITED(estado) && WEXITSTATUS(estado) == 0;
+
+    printf("Recebidos: %d, Soma: %lld, Em ordem: %s, Produtor: %s\n",
+           recebidos, soma, em_ordem ? "sim" : "nao",
+           filho_ok ? "ok" : "falhou");
+
+    remover_queue_compartilhada(&queue);
+    apagar_queue_compartilhada(NOME);
+
+    long long soma_esperada = (long long) TOTAL * (TOTAL + 1) / 2;
+    if (recebidos != TOTAL || soma != soma_esperada || !em_ordem || !filho_ok)
+        return 1;
+
+    return 0;
+}